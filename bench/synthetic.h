@@ -0,0 +1,61 @@
+//////////////////////////////////////////////////////////////////////
+// synthetic.h  Copyright (c) 2018 Dario Ghersi and Sean West       //
+// Version: 20181223                                                //
+// Goal: Survival analysis with the minimum p-value method and      //
+//       empirically estimated null distribution                    //
+//                                                                  //
+// This file is part of the NEEP suite.                             //
+// NEEP is free software: you can redistribute it and/or            //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// NEEP is distributed in the hope that it will be useful,          //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with NEEP.                                         //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _synthetic_
+#define _synthetic_
+
+#include <cstdint>
+
+#include "../neep.h"
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+class SyntheticParameters {
+
+  // shape of a synthetic cohort for benchmarking
+
+ public:
+  unsigned int numPatients;
+  unsigned int numFeatures;
+  double censorRate;       // fraction of patients without an event
+  unsigned int timeTies;   // distinct survival times (0 = any)
+  unsigned int exprTies;   // distinct expression levels (0 = any)
+  double signalFraction;   // features associated with survival
+  uint64_t seed;
+
+  SyntheticParameters();
+};
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+void generateClinical(SyntheticParameters &, vector<ClinicalSample> &);
+void generateExpression(SyntheticParameters &, vector<ClinicalSample> &,
+                        vector<ExpressionData> &);
+void writeClinical(string, vector<ClinicalSample> &);
+void writeExpression(string, vector<ClinicalSample> &,
+                     vector<ExpressionData> &);
+
+#endif
@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////
+// cache.h  Copyright (c) 2018 Dario Ghersi and Sean West           //
+// Version: 20181223                                                //
+// Goal: Survival analysis with the minimum p-value method and      //
+//       empirically estimated null distribution                    //
+//                                                                  //
+// This file is part of the NEEP suite.                             //
+// NEEP is free software: you can redistribute it and/or            //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// NEEP is distributed in the hope that it will be useful,          //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with NEEP.                                         //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _cache_
+#define _cache_
+
+#include <cstdint>
+
+#include "neep.h"
+
+// The cache file holds a fixed header followed by the null statistics
+// as raw doubles, in iteration order, so that any prefix of the file
+// is the null of a shorter run with the same seed:
+//
+//   char     magic[8]   "NEEPNUL1"
+//   uint64_t key        hashCohort() of the run
+//   uint64_t numIter    number of statistics that follow
+//   double   stat[numIter]
+//
+// The file only grows. Writers lock it, append, sync and then raise
+// numIter, so anything past numIter statistics is ignored.
+
+#define CACHE_MAGIC "NEEPNUL1"
+#define CACHE_HEADER_SIZE 24
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+uint64_t hashCohort(vector<ClinicalSample> &, double, bool, uint64_t);
+string nullCacheFileName(string, uint64_t);
+unsigned int readNullCache(string, uint64_t, vector<double> &, unsigned int);
+void writeNullCache(string, uint64_t, vector<double> &, unsigned int);
+
+#endif
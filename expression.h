@@ -0,0 +1,76 @@
+//////////////////////////////////////////////////////////////////////
+// expression.h  Copyright (c) 2018 Dario Ghersi and Sean West      //
+// Version: 20181223                                                //
+// Goal: Survival analysis with the minimum p-value method and      //
+//       empirically estimated null distribution                    //
+//                                                                  //
+// This file is part of the NEEP suite.                             //
+// NEEP is free software: you can redistribute it and/or            //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// NEEP is distributed in the hope that it will be useful,          //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with NEEP.                                         //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _expression_
+#define _expression_
+
+#include <cstdint>
+
+#include "neep.h"
+
+#define EXPRESSION_CHUNK 4096 // rows parsed and analyzed at a time
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+class ExpressionReader {
+
+  // memory-map the expression matrix and hand out its rows in chunks,
+  // keeping only the transcripts (or genes) expressed in enough
+  // samples
+
+ public:
+  vector<unsigned int> index; // the index of the clinical samples
+                              // matching the expression samples
+
+  ExpressionReader(vector<ClinicalSample> &, string, double, bool,
+                   unsigned int, unsigned int);
+  ~ExpressionReader();
+  bool readChunk(vector<ExpressionData> &, unsigned int);
+  double progress();
+  unsigned int rowsRead();
+
+ private:
+  string fileName;
+  const char *data;
+  size_t size, pos, released;
+  unsigned int numSamples, numRows;
+  double expressionThreshold;
+  bool useRanks;
+  unsigned int shardIndex; // keep the rows with row % numShards ==
+  unsigned int numShards;  // shardIndex
+
+  bool parseRow(const char *, const char *, ExpressionData &,
+                unsigned int &);
+};
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+bool isTied(ExpressionData &, unsigned int, unsigned int);
+const char *parseValue(const char *, const char *, double &);
+void sortSamples(ExpressionData &, vector<intDouble> &,
+                 vector<unsigned int> &, vector<unsigned int> &);
+
+#endif
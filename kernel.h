@@ -0,0 +1,69 @@
+//////////////////////////////////////////////////////////////////////
+// kernel.h  Copyright (c) 2018 Dario Ghersi and Sean West          //
+// Version: 20181223                                                //
+// Goal: Survival analysis with the minimum p-value method and      //
+//       empirically estimated null distribution                    //
+//                                                                  //
+// This file is part of the NEEP suite.                             //
+// NEEP is free software: you can redistribute it and/or            //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// NEEP is distributed in the hope that it will be useful,          //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with NEEP.                                         //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _kernel_
+#define _kernel_
+
+#include "neep.h"
+#include "util.h"
+
+#define NULL_LANES 8u // random orderings evaluated together
+
+// compile the SIMD kernel for AVX-512 and AVX2 as well as for the
+// baseline instruction set, picking the best one at run time; a
+// single target can be forced with -DNULL_KERNEL_TARGETS=...
+#ifndef NULL_KERNEL_TARGETS
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__linux__)
+#define NULL_KERNEL_TARGETS \
+  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define NULL_KERNEL_TARGETS
+#endif
+#endif
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+class NullKernel {
+
+  // calculate the best logrank statistics of NULL_LANES random
+  // orderings of the cohort at once; the risk set changes of each
+  // failure time are stored next to each other for all orderings, so
+  // that every pass over the failure times runs in SIMD lanes
+
+ public:
+  NullKernel(CohortLayout &);
+  void maxStatistics(vector<vector<unsigned int> > &, unsigned int,
+                     unsigned int, double *);
+
+ private:
+  CohortLayout &cohort;
+  vector<double> leaveA, leaveB; // [failure time][lane]
+  vector<double> eventsA;        // [failure time][lane]
+  vector<double> allLeaveB;      // leaveB with everyone in group B
+  vector<double> eventWeight;    // 1.0 for patients with an event
+
+  void moveToA(unsigned int, unsigned int);
+};
+
+#endif
@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////
+// metrics.h  Copyright (c) 2018 Dario Ghersi and Sean West         //
+// Version: 20181223                                                //
+// Goal: Survival analysis with the minimum p-value method and      //
+//       empirically estimated null distribution                    //
+//                                                                  //
+// This file is part of the NEEP suite.                             //
+// NEEP is free software: you can redistribute it and/or            //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// NEEP is distributed in the hope that it will be useful,          //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with NEEP.                                         //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _metrics_
+#define _metrics_
+
+///////////////////////////////////////////////////////////////////////
+// CLASSES                                                           //
+///////////////////////////////////////////////////////////////////////
+
+class PhaseMetrics {
+
+ public:
+  string name;
+  double wall;  // seconds
+  double cpu;   // seconds, summed over the threads
+};
+
+//////////////////////////////////////////////////////////////////////
+
+class ThreadMetrics {
+
+  // busy time and work items of each thread in a parallel loop,
+  // accumulated over calls
+
+ public:
+  vector<double> seconds;
+  vector<uint64_t> items;
+
+  void add(unsigned int, double, uint64_t);
+  double imbalance();
+};
+
+//////////////////////////////////////////////////////////////////////
+
+class RunMetrics {
+
+  // wall and CPU time of the phases of a run and counters of the hot
+  // loops; the counters are kept per thread and added at the end of
+  // each parallel region
+
+ public:
+  vector<PhaseMetrics> phases;
+  uint64_t numFeatures;
+  uint64_t splitsEvaluated;
+  uint64_t tiesSkipped;
+  uint64_t failureTimes;    // failure times visited by the splits
+  uint64_t permutations;
+  ThreadMetrics scanThreads;
+  ThreadMetrics nullThreads;
+
+  RunMetrics();
+  void startPhase(string);
+  void endPhase();
+  void write(string, unsigned int, unsigned int);
+
+ private:
+  unsigned int current;
+  double phaseWall;
+  double phaseCpu;
+};
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+double cpuTime();
+long peakRss();
+unsigned int threadNum();
+double wallTime();
+
+extern RunMetrics runMetrics;
+
+#endif
@@ -23,6 +23,11 @@
 #ifndef _neep_
 #define _neep_
 
+#define NULL_BATCH 1048576u    // null iterations generated at a time
+#define NULL_MAX_BINS 16777216 // bins of the null histogram
+#define ADAPTIVE_BATCH 10000u  // first batch of the adaptive null
+#define TAIL_EXCEEDANCES 250u  // null statistics used for the tail fit
+
 ///////////////////////////////////////////////////////////////////////
 // STRUCTURES                                                        //
 ///////////////////////////////////////////////////////////////////////
@@ -37,12 +42,17 @@ struct ClinicalSample {
 
 struct ExpressionData {
   string id;
+  unsigned int row;        // row in the expression file
   vector<double> exprVect;
+  vector<uint16_t> rank16; // ranks instead of values (--ranks)
+  vector<uint32_t> rank32; // same, for more than 65536 samples
 };
 
 ///////////////////////////////////////////////////////////////////////
 
 struct BestLogRank {
+  string id;
+  unsigned int row;
   double stat;
   unsigned int bestPos;
   string direction;
@@ -65,6 +75,24 @@ class Parameters {
   unsigned int numIter;
   double expressionThreshold;
   bool isUniform;
+  unsigned int numThreads;
+  uint64_t seed;
+  string cacheDir;
+  bool useRanks;
+  double nullPrecision;
+  double adaptivePrecision;
+  double fdr;
+  bool tailFit;
+  string metricsFileName;
+  bool quiet;
+  string partialFileName;        // map run: write the partial here
+  bool hasShard;                 // map run over expression rows
+  unsigned int shardIndex;
+  unsigned int numShards;
+  bool hasNullShard;             // map run over null iterations
+  unsigned int nullShardIndex;
+  unsigned int numNullShards;
+  vector<string> reduceFileNames; // reduce run: merge these partials
 
   Parameters(char **, int);
 };
@@ -81,6 +109,45 @@ class Results {
   Results(vector<double> &);
 };
 
+//////////////////////////////////////////////////////////////////////
+
+class NullHistogram {
+
+  // compact null distribution: counts of the statistics in bins of
+  // fixed width instead of one double per iteration
+
+ public:
+  double width;
+  vector<uint64_t> counts;
+  vector<double> tail; // statistics beyond the last bin
+  uint64_t total;
+
+  NullHistogram(double);
+  void add(vector<double> &);
+  void calculatePValues(vector<BestLogRank> &, vector<double> &);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+class TailModel {
+
+  // generalized Pareto model of the upper tail of the null
+  // distribution, for statistics beyond the largest null statistic
+
+ public:
+  double threshold; // statistics above it are modeled
+  double maxNull;
+  double fraction;  // fraction of the null above the threshold
+  double scale;
+  double shape;
+  unsigned int numExceed;
+  bool isValid;
+
+  TailModel(vector<double> &);
+  double pValue(double);
+  void calculatePValues(vector<BestLogRank> &, vector<double> &);
+};
+
 #endif
 
 //////////////////////////////////////////////////////////////////////
@@ -93,7 +160,11 @@ void calculateBestLogRank(vector<ExpressionData> &,
                           vector<BestLogRank> &,
 						  double);
 void calculateNull(vector<ClinicalSample> &, vector<double> &,
-                   unsigned int, double, bool);
+                   unsigned int, double, bool, uint64_t, unsigned int);
+void generateNull(vector<ClinicalSample> &, Parameters &, vector<double> &,
+                  unsigned int);
 void calculatePValues(vector<double> &, vector<BestLogRank> &,
                       vector<double> &);
+unsigned int calculateAdaptiveNull(vector<ClinicalSample> &, Parameters &,
+                                   vector<BestLogRank> &, vector<double> &);
 void printResults(string, Results &, vector<BestLogRank> &);
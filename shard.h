@@ -0,0 +1,80 @@
+//////////////////////////////////////////////////////////////////////
+// shard.h  Copyright (c) 2018 Dario Ghersi and Sean West           //
+// Version: 20181223                                                //
+// Goal: Survival analysis with the minimum p-value method and      //
+//       empirically estimated null distribution                    //
+//                                                                  //
+// This file is part of the NEEP suite.                             //
+// NEEP is free software: you can redistribute it and/or            //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// NEEP is distributed in the hope that it will be useful,          //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with NEEP.                                         //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _shard_
+#define _shard_
+
+#include <cstdint>
+
+#include "neep.h"
+
+// A map run (--partial) writes the results of its slice of the work:
+// the best logrank records of the expression rows of its shard and/or
+// a range of the null iterations. A partial file holds a fixed header,
+// the records, then the null statistics as raw doubles:
+//
+//   char     magic[8]    "NEEPPRT1"
+//   uint64_t key         partialKey() of the run
+//   uint32_t numIter     -n of the run
+//   uint32_t shardIndex  expression rows with row % numShards == shardIndex
+//   uint32_t numShards   0 if the partial has no expression rows
+//   uint32_t numRows     rows in the expression file
+//   uint32_t nullFirst   first null iteration
+//   uint32_t nullCount   number of null statistics
+//   uint64_t numRecords  number of records that follow
+//
+// and for each record: uint32_t row, uint32_t bestPos, double stat,
+// hr, mr1y, mr2y, mr5y, then the id and the direction, each as a
+// uint32_t length followed by the characters.
+
+#define PARTIAL_MAGIC "NEEPPRT1"
+
+///////////////////////////////////////////////////////////////////////
+// STRUCTURES                                                        //
+///////////////////////////////////////////////////////////////////////
+
+struct PartialHeader {
+  uint64_t key;
+  uint32_t numIter;
+  uint32_t shardIndex;
+  uint32_t numShards;
+  uint32_t numRows;
+  uint32_t nullFirst;
+  uint32_t nullCount;
+};
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+void mergePartials(vector<string> &, vector<BestLogRank> &,
+                   vector<double> &);
+uint64_t partialKey(vector<ClinicalSample> &, Parameters &);
+void parseShard(string, unsigned int &, unsigned int &);
+void readPartial(string, PartialHeader &, vector<BestLogRank> &,
+                 vector<double> &);
+void shardRange(unsigned int, unsigned int, unsigned int, unsigned int &,
+                unsigned int &);
+void writePartial(string, PartialHeader &, vector<BestLogRank> &,
+                  vector<double> &);
+
+#endif
@@ -0,0 +1,66 @@
+#!/bin/sh
+# check the split scan against the original logrank() on synthetic
+# cohorts, with and without tied survival times and expression values,
+# that --ranks gives the same output as the expression values, and
+# that a seeded null cache reproduces an uncached run when it is reused
+# and when it is extended
+
+if [ ! -e ./scan_check ]
+then
+    echo "Build the check first. In distribution directory, run 'make test/scan_check'."
+    exit 1
+fi
+if [ ! -e ../neep ] || [ ! -e ../bench/neep_generate ]
+then
+    echo "Build neep and the generator first. In distribution directory, run 'make neep bench/neep_generate'."
+    exit 1
+fi
+
+DIR=$(mktemp -d)
+trap 'rm -rf $DIR' EXIT
+
+GOOD=1
+for TIES in "" "--time-ties 40" "--expr-ties 12" "--time-ties 40 --expr-ties 12"
+do
+    for SEED in 1 2
+    do
+        if ! ./scan_check -n 250 -f 150 -t 0.15 --seed $SEED $TIES > /dev/null
+        then
+            echo "FAILURE - split scan differs from logrank() (seed $SEED $TIES)"
+            GOOD=0
+        fi
+    done
+done
+
+# tied expression values are ordered the same way with and without
+# --ranks
+../bench/neep_generate -o $DIR/ties -n 300 -f 400 --expr-ties 30 --seed 3
+for RANKS in "" "--ranks"
+do
+    ../neep -c $DIR/ties_clinical.csv -e $DIR/ties_expression.csv -o $DIR/out$RANKS.txt -n 2000 -t 0.15 --seed 3 -q $RANKS > /dev/null
+done
+if ! cmp -s $DIR/out.txt $DIR/out--ranks.txt
+then
+    echo "FAILURE - --ranks output differs from the expression values"
+    GOOD=0
+fi
+
+# null cache: fill it with part of the iterations, extend it, reuse it
+ARGS="-c $DIR/ties_clinical.csv -e $DIR/ties_expression.csv -t 0.15 --seed 5 -q"
+mkdir $DIR/cache
+../neep $ARGS -n 3000 -o $DIR/fresh.txt > /dev/null
+../neep $ARGS -n 1000 -o $DIR/first.txt --cache $DIR/cache > /dev/null
+../neep $ARGS -n 3000 -o $DIR/extended.txt --cache $DIR/cache > /dev/null
+../neep $ARGS -n 3000 -o $DIR/reused.txt --cache $DIR/cache > /dev/null
+if ! cmp -s $DIR/fresh.txt $DIR/extended.txt || ! cmp -s $DIR/fresh.txt $DIR/reused.txt
+then
+    echo "FAILURE - cached null differs from the uncached run"
+    GOOD=0
+fi
+
+if [ $GOOD = 1 ]
+then
+    echo "success (split scan identical to logrank(), --ranks and null cache identical)"
+else
+    exit 1
+fi
@@ -0,0 +1,53 @@
+#!/bin/sh
+# run NEEP as several map processes plus a reduce step and check that
+# the output is identical to a single-process run
+
+NITER=20000
+SEED=7
+
+if [ ! -e ../neep ] || [ ! -e ../bench/neep_generate ]
+then
+    echo "Build neep and the generator first. In distribution directory, run 'make neep bench/neep_generate'."
+    exit 1
+fi
+
+DIR=$(mktemp -d)
+trap 'rm -rf $DIR' EXIT
+
+../bench/neep_generate -o $DIR/shard -n 300 -f 500 --time-ties 50 --expr-ties 30 --seed $SEED
+
+../neep -c $DIR/shard_clinical.csv -e $DIR/shard_expression.csv -o $DIR/single.txt -n $NITER -t 0.15 --seed $SEED -q > /dev/null
+
+# three expression shards and two null shards, one of them combined
+# with an expression shard
+../neep -c $DIR/shard_clinical.csv -e $DIR/shard_expression.csv -n $NITER -t 0.15 --seed $SEED -q --partial $DIR/p0.bin --shard 0/3 --null-shard 0/2 > /dev/null &
+../neep -c $DIR/shard_clinical.csv -e $DIR/shard_expression.csv -n $NITER -t 0.15 --seed $SEED -q --partial $DIR/p1.bin --shard 1/3 > /dev/null &
+../neep -c $DIR/shard_clinical.csv -e $DIR/shard_expression.csv -n $NITER -t 0.15 --seed $SEED -q --partial $DIR/p2.bin --shard 2/3 > /dev/null &
+../neep -c $DIR/shard_clinical.csv -n $NITER -t 0.15 --seed $SEED -q --partial $DIR/p3.bin --null-shard 1/2 > /dev/null &
+wait
+
+../neep --reduce $DIR/p2.bin,$DIR/p0.bin,$DIR/p3.bin,$DIR/p1.bin -o $DIR/merged.txt > /dev/null
+
+if ! cmp -s $DIR/single.txt $DIR/merged.txt
+then
+    echo "FAILURE - sharded output differs from the single-process run"
+    exit 1
+fi
+
+# the reduce step must reject a null shard given twice and null shards
+# that overlap
+../neep -c $DIR/shard_clinical.csv -n $NITER -t 0.15 --seed $SEED -q --partial $DIR/p4.bin --null-shard 3/4 > /dev/null
+
+if ../neep --reduce $DIR/p0.bin,$DIR/p1.bin,$DIR/p2.bin,$DIR/p3.bin,$DIR/p3.bin -o $DIR/bad.txt > /dev/null 2>&1
+then
+    echo "FAILURE - a duplicated null shard was accepted"
+    exit 1
+fi
+if ../neep --reduce $DIR/p0.bin,$DIR/p1.bin,$DIR/p2.bin,$DIR/p3.bin,$DIR/p4.bin -o $DIR/bad.txt > /dev/null 2>&1
+then
+    echo "FAILURE - overlapping null shards were accepted"
+    exit 1
+fi
+
+N=$(($(wc -l < $DIR/merged.txt) - 1))
+echo "success ($N features identical to the single-process run)"
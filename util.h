@@ -25,10 +25,14 @@
 
 #include "neep.h"
 
+#if defined(_OPENMP) && defined(__GLIBCXX__)
+#include <parallel/algorithm>
+#endif
+
 #define MANTEL 1 // Mantel-Cox test
 //#define EXPR_THRESH 0.85 // at least x% of transcripts have to be expressed
 
-#define USAGE "\nUsage: neep -c CLINICAL -e EXPRESSION -O OUTPUT -n NUM_ITERATIONS -t EXP_THRESHOLD (-u)\n\n"
+#define USAGE "\nUsage: neep -c CLINICAL -e EXPRESSION -O OUTPUT -n NUM_ITERATIONS -t EXP_THRESHOLD (-u) (-p NUM_THREADS) (--seed SEED) (--cache DIR) (--ranks) (--null-precision WIDTH) (--adaptive PRECISION) (--fdr ALPHA) (--tail-fit) (--metrics FILE) (-q) (--partial FILE (--shard I/N) (--null-shard I/N))\n       neep --reduce PARTIAL,PARTIAL,... -o OUTPUT (--tail-fit) (--metrics FILE)\n\n"
 
 struct LrResult
 {
@@ -42,23 +46,91 @@ struct LrResult
 
 typedef pair<unsigned int, double> intDouble;
 
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+class CohortLayout {
+
+  // structure-of-arrays view of the clinical data for the logrank
+  // scans: the failure times and, for each patient, the range of
+  // failure times at which it is at risk in either group
+
+ public:
+  vector<unsigned int> failures;  // distinct failure times
+  vector<double> totEvents;       // events at each failure time
+  vector<unsigned int> failIdx;   // failure time of each patient
+  vector<unsigned int> endA;      // patient leaves the A risk set here
+  vector<unsigned int> endB;      // patient leaves the B risk set here
+  vector<unsigned int> days;
+  vector<bool> event;
+  unsigned int yearsAll[3];       // patients before 1, 2, 5 years
+
+  CohortLayout(vector<ClinicalSample> &);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+class LogRankScan {
+
+  // evaluate the logrank test for every split of a cohort ordered by
+  // expression, moving one patient at a time from group B to group A;
+  // each split costs a single pass over the failure times
+
+ public:
+  LogRankScan(CohortLayout &);
+  void reset();
+  void moveToA(unsigned int);
+  double statistic();
+  LrResult evaluate();
+
+ private:
+  CohortLayout &cohort;
+  vector<double> eventsA;         // group A events at each failure time
+  vector<unsigned int> leaveA, leaveB;
+  unsigned int sizeA, sizeB;
+  unsigned int yearsA[3];              // patients before 1, 2, 5 years
+  double totObsA, totExpA, variance;   // set by statistic()
+};
+
 //////////////////////////////////////////////////////////////////////
 // PROTOTYPES                                                       //
 //////////////////////////////////////////////////////////////////////
 
 void checkCommandLineArgs(char **, int);
 bool cmdOptionExists(char **, char **, const string&);
-vector<unsigned int> createFailureTimes(vector<unsigned int>,
-					vector<bool>,
-					vector<unsigned int>,
-					vector<bool>);
+vector<unsigned int> createFailureTimes(const vector<unsigned int> &,
+					const vector<bool> &,
+					const vector<unsigned int> &,
+					const vector<bool> &);
 bool comparator(const intDouble &, const intDouble &);
 char *getCmdOption(char **, char **, const string &);
+bool indexComparator(const intDouble &, const intDouble &);
 LrResult logrank(vector<unsigned int> &, vector<bool> &,
 	       vector<unsigned int> &, vector<bool> &);
+uint64_t mixSeed(uint64_t, uint64_t);
+void permuteSamples(vector<unsigned int> &, vector<intDouble> &, bool,
+                    mt19937_64 &);
 void printProgBar(unsigned int);
 void storeClinicalData(vector<ClinicalSample> &, string);
-void storeExpression(vector<ClinicalSample> &, vector<ExpressionData> &,
-                     vector<unsigned int> &, string, double);
+void updateProgBar(double, double &);
+
+extern bool showProgress;
+
+//////////////////////////////////////////////////////////////////////
+// TEMPLATES                                                        //
+//////////////////////////////////////////////////////////////////////
+
+template <class Iterator, class Compare>
+void parallelSort(Iterator first, Iterator last, Compare comp)
+{
+  // sort with all threads when the standard library supports it
+
+#if defined(_OPENMP) && defined(__GLIBCXX__)
+  __gnu_parallel::sort(first, last, comp);
+#else
+  sort(first, last, comp);
+#endif
+}
 
 #endif